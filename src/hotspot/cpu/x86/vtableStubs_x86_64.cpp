@@ -192,6 +192,13 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
 
   start_pc = __ pc();
 
+  // When REFC is also DECC (the common case for megamorphic interface
+  // calls), the itable scan for DECC below performs the receiver subtype
+  // check as well, so the itable only has to be walked once.
+  Label L_lookup_method;
+  __ cmpptr(resolved_klass_reg, holder_klass_reg);
+  __ jccb(Assembler::equal, L_lookup_method);
+
   // Receiver subtype check against REFC.
   // Destroys recv_klass_reg value.
   __ lookup_interface_method(// inputs: rec. class, interface
@@ -200,13 +207,14 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
                              recv_klass_reg, temp_reg,
                              L_no_such_interface,
                              /*return_method=*/false);
+  __ load_klass(recv_klass_reg, j_rarg0, temp_reg);   // restore recv_klass_reg
 
   const ptrdiff_t  typecheckSize = __ pc() - start_pc;
   start_pc = __ pc();
 
   // Get selected method from declaring class and itable index
   const Register method = rbx;
-  __ load_klass(recv_klass_reg, j_rarg0, temp_reg);   // restore recv_klass_reg
+  __ bind(L_lookup_method);
   __ lookup_interface_method(// inputs: rec. class, interface, itable index
                              recv_klass_reg, holder_klass_reg, itable_index,
                              // outputs: method, scan temp. reg
@@ -218,7 +226,8 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
   // We expect we need index_dependent_slop extra bytes. Reason:
   // The emitted code in lookup_interface_method changes when itable_index exceeds 15.
   // For linux, a very narrow estimate would be 112, but Solaris requires some more space (130).
-  const ptrdiff_t estimate = 136;
+  // The REFC == DECC shortcut adds another 5 bytes.
+  const ptrdiff_t estimate = 141;
   const ptrdiff_t codesize = typecheckSize + lookupSize + index_dependent_slop;
   slop_delta  = (int)(estimate - codesize);
   slop_bytes += slop_delta;
@@ -166,6 +166,8 @@ class ClassLoader: AllStatic {
   static PerfCounter* _perf_classes_verified;
   static PerfCounter* _perf_class_verify_time;
   static PerfCounter* _perf_class_verify_selftime;
+  static PerfCounter* _perf_methods_verified;
+  static PerfCounter* _perf_method_bytes_verified;
   static PerfCounter* _perf_classes_linked;
   static PerfCounter* _perf_class_link_time;
   static PerfCounter* _perf_class_link_selftime;
@@ -284,6 +286,8 @@ class ClassLoader: AllStatic {
   static PerfCounter* perf_classes_verified()         { return _perf_classes_verified; }
   static PerfCounter* perf_class_verify_time()        { return _perf_class_verify_time; }
   static PerfCounter* perf_class_verify_selftime()    { return _perf_class_verify_selftime; }
+  static PerfCounter* perf_methods_verified()         { return _perf_methods_verified; }
+  static PerfCounter* perf_method_bytes_verified()    { return _perf_method_bytes_verified; }
   static PerfCounter* perf_classes_linked()           { return _perf_classes_linked; }
   static PerfCounter* perf_class_link_time()          { return _perf_class_link_time; }
   static PerfCounter* perf_class_link_selftime()      { return _perf_class_link_selftime; }
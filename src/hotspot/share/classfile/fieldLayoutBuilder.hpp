@@ -100,18 +100,16 @@ class LayoutRawBlock : public ResourceObj {
   // compare_size_inverted() returns the opposite of a regular compare method in order to
   // sort fields in decreasing order.
   // Note: with line types, the comparison should include alignment constraint if sizes are equals
+  // Fields with the same size are kept in declaration order.  qsort() isn't
+  // stable (on Windows it reverses fields with the same size), and the
+  // declaration order is the only hint the layout has about which fields
+  // are used together, so it is made explicit on all platforms.
   static int compare_size_inverted(LayoutRawBlock** x, LayoutRawBlock** y)  {
-#ifdef _WINDOWS
-    // qsort() on Windows reverse the order of fields with the same size
-    // the extension of the comparison function below preserves this order
     int diff = (*y)->size() - (*x)->size();
     if (diff == 0) {
       diff = (*x)->field_index() - (*y)->field_index();
     }
     return diff;
-#else
-    return (*y)->size() - (*x)->size();
-#endif // _WINDOWS
   }
 
 };
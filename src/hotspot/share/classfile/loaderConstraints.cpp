@@ -246,6 +246,9 @@ bool LoaderConstraintTable::add_entry(Symbol* class_name,
     p->set_loader(0, class_loader1());
     p->set_loader(1, class_loader2());
     Hashtable<InstanceKlass*, mtClass>::add_entry(index, p);
+    // pp1 and pp2 point into the bucket chains, which growing relinks,
+    // but they are not used after this.
+    grow_if_needed();
 
     if (lt.is_enabled()) {
       ResourceMark rm;
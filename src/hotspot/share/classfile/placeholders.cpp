@@ -212,6 +212,8 @@ PlaceholderEntry* PlaceholderTable::add_entry(unsigned int hash,
   PlaceholderEntry* entry = new_entry(hash, class_name, loader_data, supername);
   int index = hash_to_index(hash);
   Hashtable<Symbol*, mtClass>::add_entry(index, entry);
+  // Many loaders loading classes in parallel can make the chains long.
+  grow_if_needed();
   return entry;
 }
 
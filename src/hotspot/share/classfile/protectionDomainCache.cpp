@@ -231,5 +231,7 @@ ProtectionDomainCacheEntry* ProtectionDomainCacheTable::add_entry(int index, uns
   WeakHandle w(Universe::vm_weak(), protection_domain);
   ProtectionDomainCacheEntry* p = new_entry(hash, w);
   Hashtable<WeakHandle, mtClass>::add_entry(index, p);
+  // Dictionary entries point to the cache entries, which growing doesn't move.
+  grow_if_needed();
   return p;
 }
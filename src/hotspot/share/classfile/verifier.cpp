@@ -631,6 +631,11 @@ void ClassVerifier::verify_class(TRAPS) {
 
   Array<Method*>* methods = _klass->methods();
   int num_methods = methods->length();
+  int methods_verified = 0;
+  int code_bytes_verified = 0;
+
+  LogTarget(Info, verification) lt;
+  jlong start_time = lt.is_enabled() ? os::javaTimeNanos() : 0;
 
   for (int index = 0; index < num_methods; index++) {
     // Check for recursive re-verification before each method.
@@ -644,12 +649,23 @@ void ClassVerifier::verify_class(TRAPS) {
       continue;
     }
     verify_method(methodHandle(THREAD, m), CHECK_VERIFY(this));
+    methods_verified++;
+    code_bytes_verified += m->code_size();
+  }
+
+  if (UsePerfData) {
+    ClassLoader::perf_methods_verified()->inc(methods_verified);
+    ClassLoader::perf_method_bytes_verified()->inc(code_bytes_verified);
   }
 
   if (was_recursively_verified()){
     log_info(verification)("Recursive verification detected for: %s", _klass->external_name());
     log_info(class, init)("Recursive verification detected for: %s",
                         _klass->external_name());
+  } else if (lt.is_enabled()) {
+    jlong elapsed_us = (os::javaTimeNanos() - start_time) / (NANOUNITS / MICROUNITS);
+    lt.print("Verified %d methods (%d bytecode bytes) of class %s in " JLONG_FORMAT " us",
+             methods_verified, code_bytes_verified, _klass->external_name(), elapsed_us);
   }
 }
 
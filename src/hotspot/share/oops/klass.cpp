@@ -86,6 +86,7 @@ void Klass::set_is_cloneable() {
 void Klass::set_name(Symbol* n) {
   _name = n;
   if (_name != NULL) _name->increment_refcount();
+  _hash_slot = compute_hash_slot(n);
 
   if (Arguments::is_dumping_archive() && is_instance_klass()) {
     SystemDictionaryShared::init_dumptime_info(InstanceKlass::cast(this));
@@ -109,6 +110,41 @@ void Klass::release_C_heap_structures() {
   if (_name != NULL) _name->decrement_refcount();
 }
 
+// The slot must not depend on the address of the name, since archived
+// klasses keep the bitmaps computed at dump time.
+u1 Klass::compute_hash_slot(Symbol* n) {
+  if (n == NULL) {
+    return 0;
+  }
+  juint hash = 0;
+  for (int i = 0; i < n->utf8_length(); i++) {
+    hash = 31 * hash + (u1)n->char_at(i);
+  }
+  hash ^= hash >> 16;
+  hash *= 0x9E3779B1;
+  return (u1)(hash >> (32 - LogBitsPerWord));
+}
+
+void Klass::set_secondary_supers(Array<Klass*>* k) {
+  _secondary_supers = k;
+
+  uintx bitmap = SECONDARY_SUPERS_BITMAP_EMPTY;
+  if (k == Universe::the_array_interfaces_array()) {
+    // Filled in during bootstrapping, possibly after this klass is set up.
+    bitmap = SECONDARY_SUPERS_BITMAP_FULL;
+  } else if (k != NULL) {
+    for (int i = 0; i < k->length(); i++) {
+      Klass* s = k->at(i);
+      if (s == NULL) {
+        bitmap = SECONDARY_SUPERS_BITMAP_FULL;
+        break;
+      }
+      bitmap |= (uintx)1 << s->hash_slot();
+    }
+  }
+  _secondary_supers_bitmap = bitmap;
+}
+
 bool Klass::search_secondary_supers(Klass* k) const {
   // Put some extra logic here out-of-line, before the search proper.
   // This cuts down the size of the inline method.
@@ -116,6 +152,9 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+  // No klass in the list hashes to k's slot
+  if ((_secondary_supers_bitmap & ((uintx)1 << k->hash_slot())) == 0)
+    return false;
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
@@ -136,6 +136,12 @@ class Klass : public Metadata {
   Klass*      _secondary_super_cache;
   // Array of all secondary supertypes
   Array<Klass*>* _secondary_supers;
+  // One bit per hash slot of the klasses in _secondary_supers, used to
+  // reject most negative secondary subtype checks without a scan
+  uintx       _secondary_supers_bitmap;
+  // Hash slot of this klass in other klasses' _secondary_supers_bitmap,
+  // derived from the name so that it is stable across archive dumps
+  u1          _hash_slot;
   // Ordered list of all primary supertypes
   Klass*      _primary_supers[_primary_super_limit];
   // java/lang/Class instance mirroring this class
@@ -219,7 +225,14 @@ protected:
   void set_secondary_super_cache(Klass* k) { _secondary_super_cache = k; }
 
   Array<Klass*>* secondary_supers() const { return _secondary_supers; }
-  void set_secondary_supers(Array<Klass*>* k) { _secondary_supers = k; }
+  void set_secondary_supers(Array<Klass*>* k);
+
+  static const uintx SECONDARY_SUPERS_BITMAP_EMPTY = 0;
+  static const uintx SECONDARY_SUPERS_BITMAP_FULL  = ~(uintx)0;
+
+  uintx secondary_supers_bitmap() const { return _secondary_supers_bitmap; }
+  u1 hash_slot() const                  { return _hash_slot; }
+  static u1 compute_hash_slot(Symbol* n);
 
   // Return the element of the _super chain of the given depth.
   // If there is no such element, return either NULL or this.
@@ -1429,6 +1429,14 @@ extern "C" int trace_frequency_order(const void *p0, const void *p1) {
     return b1->is_connector() ? -1 : 1;
   }
 
+  // Traces starting with an uncommon trap or a slow-path stub call are
+  // cold whatever their estimated frequency; keep them after the hot code
+  bool cold0 = b0->has_uncommon_code();
+  bool cold1 = b1->has_uncommon_code();
+  if (cold0 != cold1) {
+    return cold1 ? -1 : 1;
+  }
+
   // Pull more frequently executed blocks to the beginning
   float freq0 = b0->_freq;
   float freq1 = b1->_freq;
@@ -425,6 +425,11 @@
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
                                                                             \
+  product(size_t, C2ArenaLimit, 0, DIAGNOSTIC,                              \
+          "Bail out of a compilation whose arenas hold more than this "     \
+          "many bytes after optimization, matching or register "            \
+          "allocation. 0 means no limit")                                   \
+                                                                            \
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
@@ -675,12 +675,69 @@ void PhaseChaitin::Register_Allocate() {
     }
   }
 
+  if (log != NULL NOT_PRODUCT(|| PrintOptoStatistics)) {
+    gather_spill_statistics(log);
+  }
+
   // Done!
   _live = NULL;
   _ifg = NULL;
   C->set_indexSet_arena(NULL);  // ResourceArea is at end of scope
 }
 
+void PhaseChaitin::gather_spill_statistics(CompileLog* log) {
+  int loads = 0, stores = 0, memoves = 0, copies = 0, vector_spills = 0;
+  double load_cost = 0, store_cost = 0, memove_cost = 0, copy_cost = 0, vector_spill_cost = 0;
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* block = _cfg.get_block(i);
+    for (uint j = 1; j < block->number_of_nodes(); j++) {
+      Node* n = block->get_node(j);
+      if (!n->is_MachSpillCopy()) {
+        continue;
+      }
+      OptoReg::Name src = get_reg_first(n->in(1));
+      OptoReg::Name dst = get_reg_first(n);
+      if (!OptoReg::is_valid(src) || !OptoReg::is_valid(dst) || src == dst) {
+        continue;               // No code emitted
+      }
+      double freq = block->_freq;
+      if (OptoReg::is_stack(src) && OptoReg::is_stack(dst)) {
+        memoves++; memove_cost += freq;
+      } else if (OptoReg::is_stack(src)) {
+        loads++; load_cost += freq;
+      } else if (OptoReg::is_stack(dst)) {
+        stores++; store_cost += freq;
+      } else {
+        copies++; copy_cost += freq;
+        continue;               // Register to register, not a spill
+      }
+      if (RegMask::is_vector(n->ideal_reg())) {
+        vector_spills++; vector_spill_cost += freq;
+      }
+    }
+  }
+
+  if (log != NULL) {
+    log->elem("regalloc_spills loads='%d' stores='%d' memoves='%d' copies='%d' vector='%d'",
+              loads, stores, memoves, copies, vector_spills);
+  }
+
+#ifndef PRODUCT
+  if (PrintOptoStatistics) {
+    _final_loads += loads;
+    _final_stores += stores;
+    _final_memoves += memoves;
+    _final_copies += copies;
+    _final_load_cost += load_cost;
+    _final_store_cost += store_cost;
+    _final_memove_cost += memove_cost;
+    _final_copy_cost += copy_cost;
+    _final_vector_spills += vector_spills;
+    _final_vector_spill_cost += vector_spill_cost;
+  }
+#endif
+}
+
 void PhaseChaitin::de_ssa() {
   // Set initial Names for all Nodes.  Most Nodes get the virtual register
   // number.  A few get the ZERO live range number.  These do not
@@ -2477,6 +2534,8 @@ double PhaseChaitin::_final_load_cost  = 0;
 double PhaseChaitin::_final_store_cost = 0;
 double PhaseChaitin::_final_memove_cost= 0;
 double PhaseChaitin::_final_copy_cost  = 0;
+int PhaseChaitin::_final_vector_spills = 0;
+double PhaseChaitin::_final_vector_spill_cost = 0;
 int PhaseChaitin::_conserv_coalesce = 0;
 int PhaseChaitin::_conserv_coalesce_pair = 0;
 int PhaseChaitin::_conserv_coalesce_trie = 0;
@@ -2499,6 +2558,7 @@ void PhaseChaitin::print_chaitin_statistics() {
   tty->print_cr("Adjusted spill cost = %7.0f.",
                 _final_load_cost*4.0 + _final_store_cost  * 2.0 +
                 _final_copy_cost*1.0 + _final_memove_cost*12.0);
+  tty->print_cr("Vector spills %d, vector spill cost = %6.0f.", _final_vector_spills, _final_vector_spill_cost);
   tty->print("Conservatively coalesced %d copies, %d pairs",
                 _conserv_coalesce, _conserv_coalesce_pair);
   if( _conserv_coalesce_trie || _conserv_coalesce_quad )
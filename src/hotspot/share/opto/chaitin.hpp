@@ -35,6 +35,7 @@
 #include "opto/regalloc.hpp"
 #include "opto/regmask.hpp"
 
+class CompileLog;
 class Matcher;
 class PhaseCFG;
 class PhaseLive;
@@ -101,6 +102,11 @@ public:
   bool is_float_or_vector() const {
     return _is_float || _is_vector;
   }
+  // A spill of a wide vector moves 32 or 64 bytes to and from the
+  // stack: make these live ranges more expensive to spill than scalars.
+  double spill_cost_factor() const {
+    return (_is_vector && _num_regs >= RegMask::SlotsPerVecY) ? 2.0 : 1.0;
+  }
 
 private:
   RegMask _mask;                // Allowed registers for this LRG
@@ -767,10 +773,15 @@ private:
   // Merge nodes that are a part of a multidef lrg and produce the same value within a block.
   void merge_multidefs();
 
+  // Count the spill copies left after allocation
+  void gather_spill_statistics(CompileLog* log);
+
 private:
 
   static int _final_loads, _final_stores, _final_copies, _final_memoves;
   static double _final_load_cost, _final_store_cost, _final_copy_cost, _final_memove_cost;
+  static int _final_vector_spills;
+  static double _final_vector_spill_cost;
   static int _conserv_coalesce, _conserv_coalesce_pair;
   static int _conserv_coalesce_trie, _conserv_coalesce_quad;
   static int _post_alloc;
@@ -550,6 +550,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _stub_name(NULL),
                   _stub_entry_point(NULL),
                   _max_node_limit(MaxNodeLimit),
+                  _arena_peak(0),
                   _post_loop_opts_phase(false),
                   _inlining_progress(false),
                   _inlining_incrementally(false),
@@ -849,6 +850,7 @@ Compile::Compile( ciEnv* ci_env,
     _stub_name(stub_name),
     _stub_entry_point(NULL),
     _max_node_limit(MaxNodeLimit),
+    _arena_peak(0),
     _post_loop_opts_phase(false),
     _inlining_progress(false),
     _inlining_incrementally(false),
@@ -2153,9 +2155,21 @@ void Compile::Optimize() {
     if (has_loops()) {
       // Cleanup graph (remove dead nodes).
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
-      PhaseIdealLoop::optimize(igvn, LoopOptsMaxUnroll);
+      // Fully unrolling short loops gives constant offsets to array
+      // elements indexed by the loop variable, so small arrays can be
+      // scalar replaced. Unrolling an inner loop can make its outer loop
+      // a candidate, so repeat while loops are being removed. Each round
+      // that makes progress removes at least one loop and every unroll is
+      // checked against the node budget, so this terminates; stop early
+      // if the graph gets close to the node limit anyway.
+      int progress;
+      do {
+        progress = major_progress();
+        PhaseIdealLoop::optimize(igvn, LoopOptsMaxUnroll);
+        if (failing())  return;
+      } while (major_progress() != progress && has_loops() &&
+               live_nodes() + NodeLimitFudgeFactor < max_node_limit());
       if (major_progress()) print_method(PHASE_PHASEIDEAL_BEFORE_EA, 2);
-      if (failing())  return;
     }
     ConnectionGraph::do_analysis(this, &igvn);
 
@@ -2241,6 +2255,7 @@ void Compile::Optimize() {
     return;
   }
 
+  check_arena_limit("optimizer");
   if (failing())  return;
 
   C->clear_major_progress(); // ensure that major progress is now clear
@@ -2704,6 +2719,7 @@ void Compile::Code_Gen() {
 
   // If you have too many nodes, or if matching has failed, bail out
   check_node_count(0, "out of nodes matching instructions");
+  check_arena_limit("matcher");
   if (failing()) {
     return;
   }
@@ -2739,6 +2755,11 @@ void Compile::Code_Gen() {
       return;
     }
   }
+  // Last check before code emission
+  check_arena_limit("regalloc");
+  if (failing()) {
+    return;
+  }
 
   // Prior to register allocation we kept empty basic blocks in case the
   // the allocator needed a place to spill.  After register allocation we
@@ -4050,8 +4071,37 @@ Compile::TracePhase::~TracePhase() {
   }
 #endif
 
+  // Only record the footprint here: some phases end after the code has
+  // been installed, where a bailout is no longer possible.
+  size_t footprint = C->record_arena_footprint();
+
   if (_log != NULL) {
-    _log->done("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
+    _log->done("phase name='%s' nodes='%d' live='%d' arena='" SIZE_FORMAT "'",
+               _phase_name, C->unique(), C->live_nodes(), footprint);
+  }
+}
+
+size_t Compile::arena_footprint() {
+  return comp_arena()->size_in_bytes() +
+         node_arena()->size_in_bytes() +
+         old_arena()->size_in_bytes() +
+         type_arena()->size_in_bytes() +
+         Thread::current()->resource_area()->size_in_bytes();
+}
+
+size_t Compile::record_arena_footprint() {
+  size_t footprint = arena_footprint();
+  _arena_peak = MAX2(_arena_peak, footprint);
+  return footprint;
+}
+
+void Compile::check_arena_limit(const char* phase_name) {
+  size_t footprint = record_arena_footprint();
+  if (C2ArenaLimit > 0 && footprint > C2ArenaLimit && !failing()) {
+    if (log() != NULL) {
+      log()->elem("arena_limit phase='%s' footprint='" SIZE_FORMAT "'", phase_name, footprint);
+    }
+    record_method_not_compilable("out of arena memory");
   }
 }
 
@@ -265,6 +265,7 @@ class Compile : public Phase {
   int                   _fixed_slots;           // count of frame slots not allocated by the register
                                                 // allocator i.e. locks, original deopt pc, etc.
   uintx                 _max_node_limit;        // Max unique node count during a single compilation.
+  size_t                _arena_peak;            // Largest arena footprint seen at a phase boundary
 
   bool                  _post_loop_opts_phase;  // Loop opts are finished.
 
@@ -593,6 +594,14 @@ class Compile : public Phase {
   bool          profile_rtm() const              { return _rtm_state == ProfileRTM; }
   uint              max_node_limit() const       { return (uint)_max_node_limit; }
   void          set_max_node_limit(uint n)       { _max_node_limit = n; }
+  size_t            arena_peak() const           { return _arena_peak; }
+  // Bytes held by the compilation's arenas and the thread's resource area
+  size_t            arena_footprint();
+  // Record the footprint at a phase boundary and return it
+  size_t            record_arena_footprint();
+  // Record the footprint; bail out if over C2ArenaLimit. Only called
+  // before code emission starts.
+  void              check_arena_limit(const char* phase_name);
   bool              clinit_barrier_on_entry()       { return _clinit_barrier_on_entry; }
   void          set_clinit_barrier_on_entry(bool z) { _clinit_barrier_on_entry = z; }
 
@@ -246,11 +246,7 @@ public:
 class JavaObjectNode: public PointsToNode {
 public:
   JavaObjectNode(ConnectionGraph *CG, Node* n, EscapeState es):
-    PointsToNode(CG, n, es, JavaObject) {
-      if (es > NoEscape) {
-        set_scalar_replaceable(false);
-      }
-    }
+    PointsToNode(CG, n, es, JavaObject) {}
 };
 
 class FieldNode: public PointsToNode {
@@ -456,6 +452,10 @@ private:
   // Adjust scalar_replaceable state after Connection Graph is built.
   void adjust_scalar_replaceable_state(JavaObjectNode* jobj);
 
+  // Mark an object as not scalar replaceable and, in debug builds,
+  // report why when PrintEliminateAllocations is on.
+  void set_not_scalar_replaceable(PointsToNode* ptn NOT_PRODUCT(COMMA const char* reason)) const;
+
   // Optimize ideal graph.
   void optimize_ideal_graph(GrowableArray<Node*>& ptr_cmp_worklist,
                             GrowableArray<Node*>& storestore_worklist);
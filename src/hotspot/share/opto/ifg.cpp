@@ -774,7 +774,7 @@ void PhaseChaitin::add_input_to_liveout(Block* b, Node* n, IndexSet* liveout, do
     if (k < debug_start) {
       // A USE costs twice block frequency (once for the Load, once
       // for a Load-delay).  Rematerialized uses only cost once.
-      lrg._cost += (def->rematerialize() ? b->_freq : (b->_freq * 2));
+      lrg._cost += (def->rematerialize() ? b->_freq : (b->_freq * 2 * lrg.spill_cost_factor()));
     }
 
     if (liveout->insert(lid)) {
@@ -876,7 +876,7 @@ uint PhaseChaitin::build_ifg_physical( ResourceArea *a ) {
 
         // A DEF normally costs block frequency; rematerialized values are
         // removed from the DEF sight, so LOWER costs here.
-        lrg._cost += n->rematerialize() ? 0 : block->_freq;
+        lrg._cost += n->rematerialize() ? 0 : block->_freq * lrg.spill_cost_factor();
 
         if (!liveout.member(lid) && n->Opcode() != Op_SafePoint) {
           if (remove_node_if_not_used(block, location, n, lid, &liveout)) {
@@ -2325,6 +2325,160 @@ void PhaseIdealLoop::mark_reductions(IdealLoopTree *loop) {
   }
 }
 
+// Scalar opcode for the lane-wise operation of an integral reduction whose
+// lanes may be combined in any order, 0 if there is none.
+static int unordered_reduction_scalar_opcode(int ropc, BasicType bt) {
+  if (bt != T_INT && bt != T_LONG) {
+    // Sub-int lanes would wrap differently from the int accumulator, and
+    // floating point reductions must keep their order.
+    return 0;
+  }
+  bool is_int = (bt == T_INT);
+  switch (ropc) {
+    case Op_AddReductionVI: return Op_AddI;
+    case Op_AddReductionVL: return Op_AddL;
+    case Op_MulReductionVI: return Op_MulI;
+    case Op_MulReductionVL: return Op_MulL;
+    case Op_AndReductionV:  return is_int ? Op_AndI : Op_AndL;
+    case Op_OrReductionV:   return is_int ? Op_OrI  : Op_OrL;
+    case Op_XorReductionV:  return is_int ? Op_XorI : Op_XorL;
+    case Op_MinReductionV:  return is_int ? Op_MinI : Op_MinL;
+    case Op_MaxReductionV:  return is_int ? Op_MaxI : Op_MaxL;
+    default:                return 0;
+  }
+}
+
+// SuperWord turns a reduction into a chain of ReductionNodes, one per
+// vector of the unrolled body, each folding its vector into the scalar
+// accumulator:
+//
+//   phi(init, rN) -> r1 = R(phi, v1) -> ... -> rN = R(rN-1, vN)
+//
+// When the lanes can be combined in any order, turn the phi into a vector
+// accumulator, replace the chain with lane-wise operations and do a single
+// ReductionNode R(init, acc) after the loop.
+void PhaseIdealLoop::move_reductions_out_of_loop(IdealLoopTree *loop) {
+  CountedLoopNode* cl = loop->_head->as_CountedLoop();
+  if (!cl->is_vectorized_loop() || !cl->is_reduction_loop()) {
+    return;
+  }
+  // A strip mined loop is left through the exit of its outer loop. The
+  // outer loop's safepoint is reached at the end of every strip and still
+  // needs the scalar value there.
+  Node* exit = cl->loopexit()->proj_out(false);
+  IdealLoopTree* outer = NULL;
+  if (cl->is_strip_mined()) {
+    exit = cl->outer_loop_exit();
+    outer = loop->_parent;
+    if (exit == NULL || outer->_head != cl->outer_loop()) {
+      return;
+    }
+  }
+  for (DUIterator_Fast imax, i = cl->fast_outs(imax); i < imax; i++) {
+    Node* phi = cl->fast_out(i);
+    if (!phi->is_Phi() || phi->outcnt() != 1 || phi == cl->phi()) {
+      continue;
+    }
+    Node* last = phi->in(LoopNode::LoopBackControl);
+    if (last == NULL || last->req() != 3 || last->in(2) == NULL ||
+        last->in(2)->bottom_type()->isa_vect() == NULL) {
+      continue;
+    }
+    const TypeVect* vt = last->in(2)->bottom_type()->is_vect();
+    BasicType bt = vt->element_basic_type();
+    int sopc = unordered_reduction_scalar_opcode(last->Opcode(), bt);
+    if (sopc == 0 || !VectorNode::implemented(sopc, vt->length(), bt)) {
+      continue;
+    }
+
+    // Walk up the chain. Only the last reduction may be used outside of
+    // the chain, and then only by the phi and outside of the loop.
+    bool ok = true;
+    for (DUIterator_Fast jmax, j = last->fast_outs(jmax); j < jmax && ok; j++) {
+      Node* u = last->fast_out(j);
+      if (u != phi && loop->is_member(get_loop(ctrl_or_self(u)))) {
+        ok = false;
+      }
+    }
+    Node* first = last;
+    while (ok && first->in(1) != phi) {
+      Node* prev = first->in(1);
+      if (prev->Opcode() != last->Opcode() || prev->outcnt() != 1 ||
+          prev->in(2)->bottom_type() != vt) {
+        ok = false;
+      } else {
+        first = prev;
+      }
+    }
+    if (!ok) {
+      continue;
+    }
+
+    // Start the vector accumulator from the identity of the operation.
+    Node* identity = ReductionNode::make_reduction_input(_igvn, sopc, bt);
+    set_ctrl(identity, C->root());
+    Node* identity_vector = VectorNode::scalar2vector(identity, vt->length(), Type::get_const_basic_type(bt));
+    register_new_node(identity_vector, C->root());
+
+    Node* init = phi->in(LoopNode::EntryControl);
+    _igvn.rehash_node_delayed(phi);
+    phi->set_req_X(LoopNode::EntryControl, identity_vector, &_igvn);
+    phi->as_Type()->set_type(vt);
+    _igvn.set_type(phi, vt);
+
+    // Replace the chain top down with lane-wise operations.
+    Node* acc = phi;
+    Node* red = first;
+    while (true) {
+      Node* next = (red == last) ? NULL : red->unique_out();
+      Node* vn = VectorNode::make(sopc, acc, red->in(2), vt->length(), bt);
+      register_new_node(vn, get_ctrl(red));
+      _igvn.replace_node(red, vn);
+      acc = vn;
+      if (next == NULL) {
+        break;
+      }
+      red = next;
+    }
+
+    // Reduce once after the loop and move the outside uses over to it.
+    // Uses in the outer strip mined loop get their own reduction at the
+    // exit of the inner loop, done once per strip.
+    Node* strip_post = NULL;
+    if (outer != NULL) {
+      for (DUIterator_Fast jmax, j = acc->fast_outs(jmax); j < jmax; j++) {
+        Node* u = acc->fast_out(j);
+        if (u != phi && outer->is_member(get_loop(ctrl_or_self(u)))) {
+          strip_post = ReductionNode::make(sopc, NULL, init, acc, bt);
+          register_new_node(strip_post, cl->loopexit()->proj_out(false));
+          break;
+        }
+      }
+    }
+    Node* post = ReductionNode::make(sopc, NULL, init, acc, bt);
+    register_new_node(post, exit);
+    for (DUIterator j = acc->outs(); acc->has_out(j); j++) {
+      Node* u = acc->out(j);
+      if (u == phi || u == post || u == strip_post) {
+        continue;
+      }
+      assert(!loop->is_member(get_loop(ctrl_or_self(u))), "use must be outside of the loop");
+      Node* r = post;
+      if (strip_post != NULL && outer->is_member(get_loop(ctrl_or_self(u)))) {
+        r = strip_post;
+      }
+      _igvn.rehash_node_delayed(u);
+      int nb = u->replace_edge(acc, r, &_igvn);
+      j -= nb;
+    }
+#ifndef PRODUCT
+    if (TraceSuperWord || TraceLoopOpts) {
+      tty->print("Reduction moved out of loop "); post->dump();
+    }
+#endif
+  }
+}
+
 //------------------------------adjust_limit-----------------------------------
 // Helper function that computes new loop limit as (rc_limit-offset)/scale
 Node* PhaseIdealLoop::adjust_limit(bool is_positive_stride, Node* scale, Node* offset, Node* rc_limit, Node* old_limit, Node* pre_ctrl, bool round) {
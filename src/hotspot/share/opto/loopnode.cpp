@@ -548,6 +548,175 @@ void PhaseIdealLoop::long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_
   }
 }
 
+// Return true if exp is a constant times the long iv. The constant must
+// fit in an int.
+bool PhaseIdealLoop::is_scaled_long_iv(Node* exp, Node* iv, jlong* p_scale) {
+  exp = exp->uncast();
+  jlong scale = 0;
+  if (exp == iv) {
+    scale = 1;
+  } else if (exp->Opcode() == Op_MulL) {
+    if (exp->in(1)->uncast() == iv && exp->in(2)->is_Con()) {
+      scale = exp->in(2)->get_long();
+    } else if (exp->in(2)->uncast() == iv && exp->in(1)->is_Con()) {
+      scale = exp->in(1)->get_long();
+    }
+  } else if (exp->Opcode() == Op_LShiftL) {
+    if (exp->in(1)->uncast() == iv && exp->in(2)->is_Con()) {
+      int shift = exp->in(2)->get_int() & (BitsPerJavaLong - 1);
+      if (shift < BitsPerJavaInteger - 1) {
+        scale = CONST64(1) << shift;
+      }
+    }
+  }
+  if (scale == 0 || scale != (jint)scale || scale == min_jint) {
+    return false;
+  }
+  *p_scale = scale;
+  return true;
+}
+
+// Return true if exp is a constant times the long iv plus (or minus) an
+// offset
+bool PhaseIdealLoop::is_scaled_long_iv_plus_offset(Node* exp, Node* iv, jlong* p_scale, Node** p_offset) {
+  if (is_scaled_long_iv(exp, iv, p_scale)) {
+    Node* zero = _igvn.longcon(0);
+    set_ctrl(zero, C->root());
+    *p_offset = zero;
+    return true;
+  }
+  exp = exp->uncast();
+  int opc = exp->Opcode();
+  if (opc == Op_AddL) {
+    if (is_scaled_long_iv(exp->in(1), iv, p_scale)) {
+      *p_offset = exp->in(2);
+      return true;
+    }
+    if (is_scaled_long_iv(exp->in(2), iv, p_scale)) {
+      *p_offset = exp->in(1);
+      return true;
+    }
+  } else if (opc == Op_SubL) {
+    if (is_scaled_long_iv(exp->in(2), iv, p_scale)) {
+      *p_scale *= -1;
+      *p_offset = exp->in(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Match a range check on a long (as emitted for Objects.checkIndex() on
+// longs): if (scale * iv + offset <u range) with offset and range
+// available before the loop is entered.
+bool PhaseIdealLoop::is_long_range_check(Node* n, Node* iv, Node* head, jlong* p_scale, Node** p_offset, Node** p_range) {
+  if (n->Opcode() != Op_RangeCheck) {
+    return false;
+  }
+  Node* bol = n->in(1);
+  if (!bol->is_Bool() || bol->as_Bool()->_test._test != BoolTest::lt) {
+    return false;
+  }
+  Node* cmp = bol->in(1);
+  if (cmp->Opcode() != Op_CmpUL) {
+    return false;
+  }
+  Node* range = cmp->in(2);
+  Node* offset = NULL;
+  if (!is_scaled_long_iv_plus_offset(cmp->in(1), iv, p_scale, &offset)) {
+    return false;
+  }
+  // Objects.checkIndex() casts the length to non negative at the check
+  // for it, which is in the loop. The uncast value is the same and a
+  // negative one is clamped to 0 by transform_long_range_check(), so the
+  // new check then fails and traps as the length check would have.
+  if (!is_dominator(get_ctrl(range), head)) {
+    range = range->uncast();
+  }
+  if (!is_dominator(get_ctrl(offset), head)) {
+    offset = offset->uncast();
+  }
+  if (!is_dominator(get_ctrl(offset), head) || !is_dominator(get_ctrl(range), head)) {
+    return false;
+  }
+  *p_offset = offset;
+  *p_range = range;
+  return true;
+}
+
+static Node* clamp_long(Node* n, jlong lo, jlong hi, const TypeLong* t, PhaseIterGVN& igvn) {
+  n = MaxNode::signed_max(n, igvn.longcon(lo), TypeLong::LONG, igvn);
+  return MaxNode::signed_min(n, igvn.longcon(hi), t, igvn);
+}
+
+// Transform a long range check in the inner loop of a loop nest:
+//
+// if (scale * phi + offset <u range)
+//
+// with phi => outer_phi + inner_phi, into an int range check on the
+// inner loop iv:
+//
+// if (scale * inner_phi - lo <u hi - lo)
+//
+// With L = scale * outer_phi + offset and Q = scale * inner_phi, the
+// check is 0 <= L + Q < range. Q is known to be in [q_min, q_max]
+// (inner_phi is bounded by iters_limit) so the check becomes lo <= Q <
+// hi where lo = -L and hi = range - L are computed once per iteration
+// of the outer loop and clamped to [q_min, q_max + 1]. L and range are
+// clamped first so that computation doesn't overflow. The new check
+// never succeeds when the initial one fails. It may fail when the
+// initial one succeeds (for L > 2^62 or range > 2^61) in which case
+// the uncommon trap is taken, which is always correct.
+void PhaseIdealLoop::transform_long_range_check(Node* rc, jlong scale, Node* offset, Node* range, Node* outer_phi,
+                                                Node* inner_phi, Node* inner_head, int iters_limit, jlong stride_con) {
+  jlong q_bound = ABS(scale) * iters_limit;
+  assert(q_bound < max_jint, "scale * inner_phi must fit in an int");
+  jlong q_min = 0;
+  jlong q_max = 0;
+  if ((stride_con > 0) == (scale > 0)) {
+    q_max = q_bound;
+  } else {
+    q_min = -q_bound;
+  }
+  const jlong clamp_limit = CONST64(1) << 61;
+  const TypeLong* q_t = TypeLong::make(q_min, q_max + 1, Type::WidenMax);
+
+  Node* l = _igvn.transform(new MulLNode(outer_phi, _igvn.longcon(scale)));
+  l = _igvn.transform(new AddLNode(l, offset));
+  l = clamp_long(l, -clamp_limit, 2 * clamp_limit, TypeLong::LONG, _igvn);
+  Node* r = clamp_long(range, 0, clamp_limit, TypeLong::make(0, clamp_limit, Type::WidenMax), _igvn);
+
+  Node* lo = _igvn.transform(new SubLNode(_igvn.longcon(0), l));
+  lo = clamp_long(lo, q_min, q_max + 1, q_t, _igvn);
+  Node* hi = _igvn.transform(new SubLNode(r, l));
+  hi = clamp_long(hi, q_min, q_max + 1, q_t, _igvn);
+  hi = MaxNode::signed_max(hi, lo, q_t, _igvn);
+
+  Node* lo_int = new ConvL2INode(lo);
+  _igvn.register_new_node_with_optimizer(lo_int);
+  Node* len_int = _igvn.transform(new SubLNode(hi, lo));
+  len_int = new ConvL2INode(len_int);
+  _igvn.register_new_node_with_optimizer(len_int);
+  set_subtree_ctrl(lo_int, true);
+  set_subtree_ctrl(len_int, true);
+
+  Node* q = inner_phi;
+  if (scale != 1) {
+    Node* scale_con = _igvn.intcon((jint)scale);
+    set_ctrl(scale_con, C->root());
+    q = new MulINode(inner_phi, scale_con);
+    register_new_node(q, inner_head);
+  }
+  Node* index = new SubINode(q, lo_int);
+  register_new_node(index, inner_head);
+  Node* cmp = new CmpUNode(index, len_int);
+  register_new_node(cmp, inner_head);
+  Node* bol = new BoolNode(cmp, BoolTest::lt);
+  register_new_node(bol, inner_head);
+
+  _igvn.replace_input_of(rc, 1, bol);
+}
+
 void PhaseIdealLoop::add_empty_predicate(Deoptimization::DeoptReason reason, Node* inner_head, IdealLoopTree* loop, SafePointNode* sfpt) {
   if (!C->too_many_traps(reason)) {
     Node *cont = _igvn.intcon(1);
@@ -817,6 +986,31 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
   assert(phi_t->_hi >= phi_t->_lo, "dead phi?");
   iters_limit = (int)MIN2((julong)iters_limit, (julong)(phi_t->_hi - phi_t->_lo));
 
+  // Long range checks on the iv can be transformed to int range checks
+  // on the inner loop iv (see transform_long_range_check()) so range
+  // check elimination and vectorization apply to the inner loop. That
+  // requires scale * inner_phi to fit in an int.
+  Node_List range_checks;
+  jlong max_scale = 0;
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    jlong scale = 0;
+    Node* offset = NULL;
+    Node* range = NULL;
+    if (is_long_range_check(n, phi, x, &scale, &offset, &range)) {
+      range_checks.push(n);
+      max_scale = MAX2(max_scale, ABS(scale));
+    }
+  }
+  if (max_scale > 0) {
+    int rc_iters_limit = (int)((max_jint - 1) / max_scale);
+    if (rc_iters_limit/ABS(stride_con) >= 2) {
+      iters_limit = MIN2(iters_limit, rc_iters_limit);
+    } else {
+      range_checks.clear();
+    }
+  }
+
   LongCountedLoopEndNode* exit_test = head->loopexit();
   BoolTest::mask bt = exit_test->test_trip();
 
@@ -901,6 +1095,16 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
 
   _igvn.replace_input_of(exit_test, 1, inner_bol);
 
+  for (uint i = 0; i < range_checks.size(); i++) {
+    Node* rc = range_checks.at(i);
+    jlong scale = 0;
+    Node* offset = NULL;
+    Node* range = NULL;
+    bool is_rc = is_long_range_check(rc, phi, x, &scale, &offset, &range);
+    assert(is_rc, "range check should not have changed");
+    transform_long_range_check(rc, scale, offset, range, outer_phi, inner_phi, x, iters_limit, stride_con);
+  }
+
   // Clone inner loop phis to outer loop
   for (uint i = 0; i < head->outcnt(); i++) {
     Node* u = head->raw_out(i);
@@ -4089,6 +4293,7 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
           }
         } else if (cl->is_main_loop()) {
           sw.transform_loop(lpt, true);
+          move_reductions_out_of_loop(lpt);
         }
       }
     }
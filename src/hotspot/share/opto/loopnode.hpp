@@ -1170,6 +1170,11 @@ public:
 
   void long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_iv, Node* outer_phi, Node* inner_head);
   bool transform_long_counted_loop(IdealLoopTree* loop, Node_List &old_new);
+  bool is_scaled_long_iv(Node* exp, Node* iv, jlong* p_scale);
+  bool is_scaled_long_iv_plus_offset(Node* exp, Node* iv, jlong* p_scale, Node** p_offset);
+  bool is_long_range_check(Node* n, Node* iv, Node* head, jlong* p_scale, Node** p_offset, Node** p_range);
+  void transform_long_range_check(Node* rc, jlong scale, Node* offset, Node* range, Node* outer_phi,
+                                  Node* inner_phi, Node* inner_head, int iters_limit, jlong stride_con);
 #ifdef ASSERT
   bool convert_to_long_loop(Node* cmp, Node* phi, IdealLoopTree* loop);
 #endif
@@ -1269,6 +1274,10 @@ public:
   // Mark vector reduction candidates before loop unrolling
   void mark_reductions( IdealLoopTree *loop );
 
+  // Keep a vector accumulator across iterations of a vectorized loop and
+  // do the horizontal reduction once after the loop
+  void move_reductions_out_of_loop( IdealLoopTree *loop );
+
   // Return true if exp is a constant times an induction var
   bool is_scaled_iv(Node* exp, Node* iv, int* p_scale);
 
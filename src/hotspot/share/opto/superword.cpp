@@ -139,6 +139,14 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
         tty->print("cl_exit->in(0) %d", cl_exit->in(0)->_idx); cl_exit->in(0)->dump();
         tty->print("lpt->_head %d", lpt->_head->_idx); lpt->_head->dump();
         lpt->dump_head();
+        // Conditionals in the body are what keeps the loop from being
+        // vectorized; list them to spot if-conversion candidates.
+        for (uint i = 0; i < lpt->_body.size(); i++) {
+          Node* n = lpt->_body.at(i);
+          if (n->is_If() && n != cl_exit) {
+            tty->print("control flow in body: "); n->dump();
+          }
+        }
       }
     #endif
     return;
@@ -146,6 +154,12 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
 
   // Make sure the are no extra control users of the loop backedge
   if (cl->back_control()->outcnt() != 1) {
+    #ifndef PRODUCT
+      if (TraceSuperWord) {
+        tty->print_cr("SuperWord::transform_loop: loop too complicated, extra control users of the backedge");
+        cl->back_control()->dump();
+      }
+    #endif
     return;
   }
 
@@ -466,6 +480,7 @@ void SuperWord::SLP_extract() {
 #endif
   // Ready the block
   if (!construct_bb()) {
+    NOT_PRODUCT(if (TraceSuperWord) tty->print_cr("SuperWord::SLP_extract: construct_bb failed");)
     return; // Exit if no interesting nodes or complex graph.
   }
 
@@ -1100,7 +1115,7 @@ void SuperWord::dependence_graph() {
           // Create a runtime check to disambiguate
           OrderedPair pp(p1.base(), p2.base());
           _disjoint_ptrs.append_if_missing(pp);
-        } else if (!SWPointer::not_equal(cmp)) {
+        } else if (!SWPointer::not_equal(cmp) && !disjoint_bases(p1, p2)) {
           // Possibly same address
           _dg.make_edge(s1, s2);
           sink_dependent = false;
@@ -1133,6 +1148,28 @@ void SuperWord::dependence_graph() {
 
 }
 
+//------------------------------disjoint_bases---------------------------
+// An array allocated in this compilation can't be the same object as
+// another allocation or as an incoming argument, so accesses through
+// them never depend on each other.
+bool SuperWord::disjoint_bases(SWPointer& p1, SWPointer& p2) {
+  if (!p1.valid() || !p2.valid() || p1.base() == p2.base()) {
+    return false;
+  }
+  AllocateNode* alloc1 = AllocateNode::Ideal_allocation(p1.base(), &_igvn);
+  AllocateNode* alloc2 = AllocateNode::Ideal_allocation(p2.base(), &_igvn);
+  if (alloc1 != NULL && alloc2 != NULL) {
+    return alloc1 != alloc2;
+  }
+  if (alloc1 != NULL) {
+    return p2.base()->uncast()->is_Parm();
+  }
+  if (alloc2 != NULL) {
+    return p1.base()->uncast()->is_Parm();
+  }
+  return false;
+}
+
 //---------------------------mem_slice_preds---------------------------
 // Return a memory slice (node list) in predecessor order starting at "start"
 void SuperWord::mem_slice_preds(Node* start, Node* stop, GrowableArray<Node*> &preds) {
@@ -3828,7 +3865,8 @@ bool SWPointer::scaled_iv_plus_offset(Node* n) {
   }
 
   int opc = n->Opcode();
-  if (opc == Op_AddI) {
+  if (opc == Op_AddI || opc == Op_AddL) {
+    // AddL: (invariant + ConvI2L(iv)) from the inner loop of a long loop nest
     if (offset_plus_k(n->in(2)) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_4(n);)
       return true;
@@ -3890,7 +3928,7 @@ bool SWPointer::scaled_iv(Node* n) {
       NOT_PRODUCT(_tracer.scaled_iv_6(n, _scale);)
       return true;
     }
-  } else if (opc == Op_ConvI2L || opc == Op_CastII) {
+  } else if (opc == Op_ConvI2L || opc == Op_CastII || opc == Op_CastLL) {
     if (scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_7(n);)
       return true;
@@ -4112,7 +4150,7 @@ void SWPointer::Tracer::scaled_iv_plus_offset_3(Node* n) {
 
 void SWPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
   if(_slp->is_trace_alignment()) {
-    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(1) is scaled_iv: ", n->in(1)->_idx); n->in(1)->dump();
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(2) is offset_plus_k: ", n->in(2)->_idx); n->in(2)->dump();
   }
@@ -4120,7 +4158,7 @@ void SWPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
 
 void SWPointer::Tracer::scaled_iv_plus_offset_5(Node* n) {
   if(_slp->is_trace_alignment()) {
-    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(2) is scaled_iv: ", n->in(2)->_idx); n->in(2)->dump();
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(1) is offset_plus_k: ", n->in(1)->_idx); n->in(1)->dump();
   }
@@ -454,6 +454,8 @@ class SuperWord : public ResourceObj {
   bool pack_parallel();
   // Construct dependency graph.
   void dependence_graph();
+  // Are the bases of p1 and p2 known to be different objects?
+  bool disjoint_bases(SWPointer& p1, SWPointer& p2);
   // Return a memory slice (node list) in predecessor order starting at "start"
   void mem_slice_preds(Node* start, Node* stop, GrowableArray<Node*> &preds);
   // Can s1 and s2 be in a pack with s1 immediately preceding s2 and  s1 aligned at "align"
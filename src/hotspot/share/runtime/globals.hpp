@@ -948,6 +948,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uint, ThreadSMRFreeListBatchSize, 8, DIAGNOSTIC,                  \
+          "Number of ThreadsLists to accumulate on the Thread SMR "         \
+          "to-delete list before scanning hazard pointers to free them")    \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, UseNotificationThread, true,                                \
           "Use Notification Thread")                                        \
                                                                             \
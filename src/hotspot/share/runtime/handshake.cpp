@@ -390,6 +390,104 @@ void Handshake::execute(HandshakeClosure* hs_cl, JavaThread* target) {
   log_handshake_info(start_time_ns, op.name(), 1, emitted_handshakes_executed);
 }
 
+void Handshake::execute(HandshakeClosure* hs_cl, ThreadsListHandle* tlh,
+                        JavaThread* const* targets, int num_targets) {
+  JavaThread* self = JavaThread::current();
+  // A NULL target since the operation is shared by several threads.
+  HandshakeOperation op(hs_cl, NULL, self);
+
+  jlong start_time_ns = os::javaTimeNanos();
+
+  // Only the targets still alive are issued the operation; remember
+  // them so the others are never looked at again. A target listed more
+  // than once is only issued the operation once. The requester can't
+  // handshake itself: if it is a target it executes the closure inline.
+  ResourceMark rm(self);
+  JavaThread** issued = NEW_RESOURCE_ARRAY(JavaThread*, num_targets);
+  int number_of_threads_issued = 0;
+  bool self_is_target = false;
+  for (int i = 0; i < num_targets; i++) {
+    JavaThread* target = targets[i];
+    if (target == self) {
+      self_is_target = true;
+      continue;
+    }
+    if (!tlh->includes(target)) {
+      continue;
+    }
+    bool duplicate = false;
+    for (int j = 0; j < number_of_threads_issued; j++) {
+      if (issued[j] == target) {
+        duplicate = true;
+        break;
+      }
+    }
+    if (!duplicate) {
+      target->handshake_state()->add_operation(&op);
+      issued[number_of_threads_issued++] = target;
+    }
+  }
+
+  if (self_is_target) {
+    // Same rule as in HandshakeOperation::do_handshake(): the closure
+    // must not safepoint.
+    NoSafepointVerifier nsv;
+    hs_cl->do_thread(self);
+  }
+
+  if (number_of_threads_issued < 1) {
+    if (self_is_target) {
+      log_handshake_info(start_time_ns, op.name(), 1, 1);
+    } else {
+      log_handshake_info(start_time_ns, op.name(), 0, 0, "no threads alive");
+    }
+    return;
+  }
+  // op was created with a count == 1 so don't double count.
+  op.add_target_count(number_of_threads_issued - 1);
+
+  // Keeps count on how many of own emitted handshakes
+  // this thread execute.
+  int emitted_handshakes_executed = 0;
+  HandshakeSpinYield hsy(start_time_ns);
+  while (!op.is_completed()) {
+    // Process the targets that are observed blocked or in native; the
+    // others will execute the operation themselves at their next poll.
+    for (int i = 0; i < number_of_threads_issued; i++) {
+      HandshakeState::ProcessResult pr = issued[i]->handshake_state()->try_process(&op);
+      hsy.add_result(pr);
+      if (pr == HandshakeState::_succeeded) {
+        emitted_handshakes_executed++;
+      }
+    }
+    if (op.is_completed()) {
+      break;
+    }
+
+    // Check if handshake operation has timed out
+    check_handshake_timeout(start_time_ns, &op);
+
+    // Check for pending handshakes to avoid possible deadlocks where one
+    // of our targets is trying to handshake us.
+    if (SafepointMechanism::should_process(self)) {
+      ThreadBlockInVM tbivm(self);
+    }
+    hsy.process();
+  }
+
+  // This pairs up with the release store in do_handshake(). It prevents future
+  // loads from floating above the load of _pending_threads in is_completed()
+  // and thus prevents reading stale data modified in the handshake closure
+  // by the Handshakee.
+  OrderAccess::acquire();
+
+  if (self_is_target) {
+    number_of_threads_issued++;
+    emitted_handshakes_executed++;
+  }
+  log_handshake_info(start_time_ns, op.name(), number_of_threads_issued, emitted_handshakes_executed);
+}
+
 void Handshake::execute(AsyncHandshakeClosure* hs_cl, JavaThread* target) {
   jlong start_time_ns = os::javaTimeNanos();
   AsyncHandshakeOperation* op = new AsyncHandshakeOperation(hs_cl, target, start_time_ns);
@@ -59,12 +59,23 @@ class AsyncHandshakeClosure : public HandshakeClosure {
    virtual bool is_async()          { return true; }
 };
 
+class ThreadsListHandle;
+
 class Handshake : public AllStatic {
  public:
   // Execution of handshake operation
   static void execute(HandshakeClosure*       hs_cl);
   static void execute(HandshakeClosure*       hs_cl, JavaThread* target);
   static void execute(AsyncHandshakeClosure*  hs_cl, JavaThread* target);
+  // Execute hs_cl for each of the distinct targets protected by tlh. The
+  // operation is queued on every target before the requester starts
+  // processing, so the targets are handshaked concurrently with a single
+  // poll each rather than one after the other. The closure may therefore
+  // be executed for several targets in parallel. Duplicate targets are
+  // handshaked once, and the requester, if it is a target, executes the
+  // closure for itself inline.
+  static void execute(HandshakeClosure*       hs_cl, ThreadsListHandle* tlh,
+                      JavaThread* const* targets, int num_targets);
 };
 
 class JvmtiRawMonitor;
@@ -40,6 +40,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -66,6 +67,7 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.inline.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -103,6 +105,24 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
   }
 }
 
+static void post_safepoint_last_thread_event(EventSafepointLastThread& event,
+                                             uint64_t safepoint_id,
+                                             JavaThread* thread,
+                                             Method* method,
+                                             int bci,
+                                             bool compiled,
+                                             address pc) {
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_lastThread(JFR_THREAD_ID(thread));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_compiled(compiled);
+    event.set_pc((u8)pc);
+    event.commit();
+  }
+}
+
 static void post_safepoint_cleanup_task_event(EventSafepointCleanupTask& event,
                                               uint64_t safepoint_id,
                                               const char* name) {
@@ -205,7 +225,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads,
+                                              int* initial_running, JavaThread** last_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -235,6 +256,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_running = NULL;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -256,7 +278,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
     while (cur_tss != NULL) {
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
-        --still_running;
+        if (--still_running == 0) {
+          // Remember the thread that kept us waiting the longest.
+          *last_running = cur_tss->thread();
+        }
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -282,6 +307,50 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   return iterations;
 }
 
+// Report where the last thread to reach the safepoint has stopped. That
+// thread determined the time to safepoint, so its top frame is usually the
+// long running loop (or the VM code) that delayed the safepoint.
+void SafepointSynchronize::report_last_running_thread(JavaThread* thread) {
+  EventSafepointLastThread event;
+  LogTarget(Debug, safepoint, stats) lt;
+  if (!event.should_commit() && !lt.is_enabled()) {
+    return;
+  }
+  assert(!thread->safepoint_state()->is_running(), "must be stopped");
+
+  ResourceMark rm;
+  Method* method = NULL;
+  int bci = -1;
+  bool compiled = false;
+  address pc = NULL;
+  if (thread->has_last_Java_frame()) {
+    pc = thread->last_frame().pc();
+    // Only method and bci are read, so the frames need no GC processing.
+    vframeStream vfst(thread, false /* stop_at_java_call_stub */, false /* process_frames */);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+      bci = vfst.bci();
+      compiled = !vfst.is_interpreted_frame();
+    }
+  }
+
+  post_safepoint_last_thread_event(event, _safepoint_id, thread, method, bci, compiled, pc);
+
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("Last thread to reach safepoint: \"%s\" " INTPTR_FORMAT,
+             thread->name(), p2i(thread));
+    if (method != NULL) {
+      ls.print(", %s frame %s @ bci %d, pc " INTPTR_FORMAT,
+               compiled ? "compiled" : "interpreted",
+               method->name_and_sig_as_C_string(), bci, p2i(pc));
+    } else {
+      ls.print(", no Java frames");
+    }
+    ls.cr();
+  }
+}
+
 void SafepointSynchronize::arm_safepoint() {
   // Begin the process of bringing the system to a safepoint.
   // Java threads can be in several different states and are
@@ -372,12 +441,13 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  JavaThread* last_running = NULL;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_running);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -426,6 +496,10 @@ void SafepointSynchronize::begin() {
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
+  if (last_running != NULL) {
+    report_last_running_thread(last_running);
+  }
+
   // We do the safepoint cleanup first since a GC related safepoint
   // needs cleanup to be completed before running the GC op.
   EventSafepointCleanup cleanup_event;
@@ -134,6 +134,19 @@ uint                  ThreadsSMRSupport::_to_delete_list_cnt = 0;
 // Impl note: See _to_delete_list_cnt note.
 uint                  ThreadsSMRSupport::_to_delete_list_max = 0;
 
+// # of ThreadsLists added to the to-delete list since the last hazard
+// ptr scan. Compared against ThreadSMRFreeListBatchSize to batch scans.
+uint                  ThreadsSMRSupport::_to_delete_list_unscanned_cnt = 0;
+
+// # of hazard ptr scans done by free_list() over VM lifetime.
+// Impl note: See _java_thread_list_alloc_cnt note.
+uint64_t              ThreadsSMRSupport::_free_list_scan_cnt = 0;
+
+// Cumulative time in micros spent in free_list() hazard ptr scans.
+// Impl note: Millis are too coarse for a single scan so use micros
+// and a 64-bit counter since free_list() is called with Threads_lock.
+uint64_t              ThreadsSMRSupport::_free_list_scan_times = 0;
+
 // 'inline' functions first so the definitions are before first use:
 
 inline void ThreadsSMRSupport::add_deleted_thread_times(uint add_value) {
@@ -217,43 +230,28 @@ class ThreadScanHashtable : public CHeapObj<mtThread> {
   }
 };
 
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 2
-// of the dance - adding all the JavaThreads referenced by the hazard
-// pointer (ThreadsList reference) to the hash table.
+// Closure to determine if a specific JavaThread is indirectly referenced
+// by a hazard ptr (ThreadsList reference). Rather than gathering every
+// JavaThread reachable from every hazard ptr into a hash table, each
+// stable hazard ptr is searched directly for the target. Most threads
+// share the current _java_thread_list as their hazard ptr so the last
+// list known not to contain the target is remembered and skipped.
 //
-class AddThreadHazardPointerThreadClosure : public ThreadClosure {
+class ScanHazardPtrProtectsThreadClosure : public ThreadClosure {
  private:
-  ThreadScanHashtable *_table;
-
+  JavaThread *_thread;
+  ThreadsList *_last_miss;
+  bool _found;
  public:
-  AddThreadHazardPointerThreadClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrProtectsThreadClosure(JavaThread *thread) :
+    _thread(thread), _last_miss(NULL), _found(false) {}
 
-  virtual void do_thread(Thread *thread) {
-    if (!_table->has_entry((void*)thread)) {
-      // The same JavaThread might be on more than one ThreadsList or
-      // more than one thread might be using the same ThreadsList. In
-      // either case, we only need a single entry for a JavaThread.
-      _table->add_entry((void*)thread);
-    }
-  }
-};
-
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 1
-// of the dance - hazard ptr chain walking and dispatch to another
-// closure.
-//
-class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
- private:
-  ThreadScanHashtable *_table;
- public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
+  bool found() const { return _found; }
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
 
-    if (thread == NULL) return;
+    if (thread == NULL || _found) return;
 
     // This code races with ThreadsSMRSupport::acquire_stable_list() which
     // is lock-free so we have to handle some special situations.
@@ -288,8 +286,12 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
     // ThreadsList.
-    AddThreadHazardPointerThreadClosure add_cl(_table);
-    current_list->threads_do(&add_cl);
+    if (current_list == _last_miss) return;
+    if (current_list->includes(_thread)) {
+      _found = true;
+    } else {
+      _last_miss = current_list;
+    }
   }
 };
 
@@ -863,13 +865,30 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 
   threads->set_next_list(_to_delete_list);
   _to_delete_list = threads;
+  _to_delete_list_cnt++;
   if (EnableThreadSMRStatistics) {
-    _to_delete_list_cnt++;
     if (_to_delete_list_cnt > _to_delete_list_max) {
       _to_delete_list_max = _to_delete_list_cnt;
     }
   }
 
+  // Scanning the hazard ptrs is O(# threads), so rather than doing it
+  // for every Threads::add() or Threads::remove() we let a batch of
+  // ThreadsLists accumulate on the to-delete list and free them all
+  // with a single scan. None of the pending ThreadsLists are walked
+  // while they are waiting so deferring the free is safe.
+  _to_delete_list_unscanned_cnt++;
+  if (_to_delete_list_unscanned_cnt < ThreadSMRFreeListBatchSize) {
+    log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+  _to_delete_list_unscanned_cnt = 0;
+
+  jlong scan_start = 0;
+  if (EnableThreadSMRStatistics) {
+    scan_start = os::javaTimeNanos();
+  }
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
@@ -897,9 +916,9 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
       log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is freed.", os::current_thread_id(), p2i(current));
       if (current == threads) threads_is_freed = true;
       delete current;
+      _to_delete_list_cnt--;
       if (EnableThreadSMRStatistics) {
         _java_thread_list_free_cnt++;
-        _to_delete_list_cnt--;
       }
     } else {
       prev = current;
@@ -917,6 +936,11 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
   threads_do(&validate_cl);
 
   delete scan_table;
+
+  if (EnableThreadSMRStatistics) {
+    _free_list_scan_cnt++;
+    _free_list_scan_times += (uint64_t)((os::javaTimeNanos() - scan_start) / NANOSECS_PER_MICROSEC);
+  }
 }
 
 // Return true if the specified JavaThread is protected by a hazard
@@ -925,34 +949,29 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   assert_locked_or_safepoint(Threads_lock);
 
-  // Gather a hash table of the JavaThreads indirectly referenced by
-  // hazard ptrs.
-  ThreadScanHashtable *scan_table = new ThreadScanHashtable();
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  // Search the ThreadsLists referenced by hazard ptrs for the
+  // JavaThread.
+  ScanHazardPtrProtectsThreadClosure scan_cl(thread);
   threads_do(&scan_cl);
+  if (scan_cl.found()) {
+    return true;
+  }
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
 
   // Walk through the linked list of pending freeable ThreadsLists
-  // and include the ones that are currently in use by a nested
-  // ThreadsListHandle in the search set.
-  ThreadsList* current = _to_delete_list;
-  while (current != NULL) {
-    if (current->_nested_handle_cnt != 0) {
-      // 'current' is in use by a nested ThreadsListHandle so the hazard
-      // ptr is protecting all the JavaThreads on that ThreadsList.
-      AddThreadHazardPointerThreadClosure add_cl(scan_table);
-      current->threads_do(&add_cl);
+  // and search the ones that are currently in use by a nested
+  // ThreadsListHandle.
+  for (ThreadsList* current = _to_delete_list;
+       current != NULL;
+       current = current->next_list()) {
+    // If 'current' is in use by a nested ThreadsListHandle, then the
+    // hazard ptr is protecting all the JavaThreads on that ThreadsList.
+    if (current->_nested_handle_cnt != 0 && current->includes(thread)) {
+      return true;
     }
-    current = current->next_list();
   }
-
-  bool thread_is_protected = false;
-  if (scan_table->has_entry((void*)thread)) {
-    thread_is_protected = true;
-  }
-  delete scan_table;
-  return thread_is_protected;
+  return false;
 }
 
 // Wake up portion of the release stable ThreadsList protocol;
@@ -1220,6 +1239,13 @@ void ThreadsSMRSupport::print_info_on(outputStream* st) {
                  _delete_lock_wait_cnt, _delete_lock_wait_max);
     st->print_cr("_to_delete_list_cnt=%u, _to_delete_list_max=%u",
                  _to_delete_list_cnt, _to_delete_list_max);
+    if (_free_list_scan_cnt > 0) {
+      st->print_cr("_free_list_scan_cnt=" UINT64_FORMAT
+                   ", _free_list_scan_times=" UINT64_FORMAT
+                   ", avg_free_list_scan_time=%0.2f",
+                   _free_list_scan_cnt, _free_list_scan_times,
+                   ((double) _free_list_scan_times / _free_list_scan_cnt));
+    }
   }
   if (needs_unlock) {
     Threads_lock->unlock();
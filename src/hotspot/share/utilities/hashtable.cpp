@@ -159,6 +159,17 @@ template <MEMFLAGS F> bool BasicHashtable<F>::resize(int new_size) {
   return true;
 }
 
+template <MEMFLAGS F> bool BasicHashtable<F>::grow_if_needed(int load_factor) {
+  if (number_of_entries() <= load_factor * table_size()) {
+    return false;
+  }
+  int desired_size = calculate_resize(false);
+  if (desired_size <= table_size()) {
+    return false;  // already at the largest size
+  }
+  return resize(desired_size);
+}
+
 template <MEMFLAGS F> bool BasicHashtable<F>::maybe_grow(int max_size, int load_factor) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
@@ -176,6 +176,12 @@ public:
   // Grow the number of buckets if the average entries per bucket is over the load_factor
   bool maybe_grow(int max_size, int load_factor = 8);
 
+  // Same, but grows to the next size from calculate_resize() and can be used
+  // outside of a safepoint by tables whose readers and writers all hold the
+  // same lock as the caller.  Entries are relinked, not copied, so pointers to
+  // entries stay valid; pointers into bucket chains do not.
+  bool grow_if_needed(int load_factor = 5);
+
   template <class T> void verify_table(const char* table_name) PRODUCT_RETURN;
 };
 
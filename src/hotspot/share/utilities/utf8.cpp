@@ -325,25 +325,29 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
                  + ((str[4] & 0x0f) << 6)  + (str[5] & 0x3f);
 }
 
-bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
-                         bool version_leq_47) {
+// Returns the index of the first word of buffer that holds a zero or
+// non-ASCII byte, or of the partial word at the end.  The bytes from there
+// on must be checked one at a time.  Most constant pool UTF-8 entries
+// (names and signatures) are all ASCII, so this skips over them quickly.
+static int skip_legal_ascii(const unsigned char* buffer, int length) {
+  const uint64_t low_bits  = CONST64(0x0101010101010101);
+  const uint64_t high_bits = CONST64(0x8080808080808080);
   int i = 0;
-  int count = length >> 2;
-  for (int k=0; k<count; k++) {
-    unsigned char b0 = buffer[i];
-    unsigned char b1 = buffer[i+1];
-    unsigned char b2 = buffer[i+2];
-    unsigned char b3 = buffer[i+3];
-    // For an unsigned char v,
+  for (; i + (int)sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, buffer + i, sizeof(word));
+    // For a byte v in a word where all the bytes below v are in [1, 127],
     // (v | v - 1) is < 128 (highest bit 0) for 0 < v < 128;
     // (v | v - 1) is >= 128 (highest bit 1) for v == 0 or v >= 128.
-    unsigned char res = b0 | b0 - 1 |
-                        b1 | b1 - 1 |
-                        b2 | b2 - 1 |
-                        b3 | b3 - 1;
-    if (res >= 128) break;
-    i += 4;
+    // So the first byte that is 0 or >= 128 sets a high bit.
+    if (((word | (word - low_bits)) & high_bits) != 0) break;
   }
+  return i;
+}
+
+bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
+                         bool version_leq_47) {
+  int i = skip_legal_ascii(buffer, length);
   for(; i < length; i++) {
     unsigned short c;
     // no embedded zeros
@@ -37,3 +37,12 @@ TEST_VM(InstanceKlass, string_klass) {
   InstanceKlass* klass = vmClasses::String_klass();
   ASSERT_TRUE(!klass->is_class_loader_instance_klass());
 }
+
+TEST_VM(InstanceKlass, secondary_supers_bitmap) {
+  InstanceKlass* klass = vmClasses::String_klass();
+  InstanceKlass* serializable = vmClasses::Serializable_klass();
+  ASSERT_NE(klass->secondary_supers_bitmap() & ((uintx)1 << serializable->hash_slot()), (uintx)0);
+  ASSERT_TRUE(klass->is_subtype_of(serializable));
+  ASSERT_FALSE(klass->is_subtype_of(vmClasses::Cloneable_klass()));
+  ASSERT_EQ(vmClasses::Object_klass()->secondary_supers_bitmap(), Klass::SECONDARY_SUPERS_BITMAP_EMPTY);
+}
@@ -22,8 +22,10 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
+#include "threadHelper.inline.hpp"
 #include "unittest.hpp"
 
 class ThreadsListHandleTest : public ::testing::Test {
@@ -71,8 +73,43 @@ class ThreadsListHandleTest : public ::testing::Test {
     static bool get_STLP_needs_release(SafeThreadsListPtr* stlp_p) {
       return stlp_p->_needs_release;
     }
+
+    // Accessors for the ThreadsSMRSupport class:
+    //
+    // Return true if the ThreadsList is on the private
+    // ThreadsSMRSupport::_to_delete_list, i.e. it is not freed yet:
+    static bool is_on_to_delete_list(ThreadsList* tl_p) {
+      MutexLocker ml(Threads_lock);
+      for (ThreadsList* current = ThreadsSMRSupport::_to_delete_list;
+           current != NULL; current = current->next_list()) {
+        if (current == tl_p) {
+          return true;
+        }
+      }
+      return false;
+    }
 };
 
+// Each start of one of these threads replaces the ThreadsList and passes
+// the old one to ThreadsSMRSupport::free_list(), as does its exit.
+class ShortLivedTestThread : public JavaTestThread {
+public:
+  ShortLivedTestThread(Semaphore* post) : JavaTestThread(post) {}
+  virtual ~ShortLivedTestThread() {}
+  void main_run() {}
+};
+
+static void replace_threads_list(uint count) {
+  Semaphore post;
+  for (uint i = 0; i < count; i++) {
+    ShortLivedTestThread* t = new ShortLivedTestThread(&post);
+    t->doit();
+  }
+  for (uint i = 0; i < count; i++) {
+    post.wait();
+  }
+}
+
 TEST_VM(ThreadsListHandle, sanity) {
   bool saved_flag_val = EnableThreadSMRStatistics;
   EnableThreadSMRStatistics = true;  // enable Thread::_nested_threads_hazard_ptr_cnt
@@ -684,3 +721,55 @@ TEST_VM(ThreadsListHandle, sanity) {
 
   EnableThreadSMRStatistics = saved_flag_val;
 }
+
+// ThreadsLists replaced while fewer than ThreadSMRFreeListBatchSize are
+// pending wait on the to-delete list for the next hazard ptr scan. A
+// ThreadsList held by nested ThreadsListHandles must survive the scans,
+// and must be freed by a later scan once the handles are gone.
+TEST_VM(ThreadsListHandle, deferred_free_list) {
+  uint saved_batch_size = ThreadSMRFreeListBatchSize;
+
+  auto doit = [&](JavaThread* thr) {
+    // Below the batch size nothing is freed.
+    ThreadSMRFreeListBatchSize = 1024;
+    ThreadsList* deferred = ThreadsSMRSupport::get_java_thread_list();
+    replace_threads_list(1);
+    EXPECT_TRUE(ThreadsListHandleTest::is_on_to_delete_list(deferred))
+        << "a replaced ThreadsList must wait for the batch";
+
+    ThreadSMRFreeListBatchSize = 2;
+    ThreadsList* held = NULL;
+    {
+      ThreadsListHandle tlh1;
+      held = tlh1.list();
+      {
+        ThreadsListHandle tlh2;
+        // Enough ThreadsList changes to cross the batch size a few times.
+        replace_threads_list(4 * ThreadSMRFreeListBatchSize);
+
+        EXPECT_TRUE(ThreadsListHandleTest::is_on_to_delete_list(held))
+            << "a ThreadsList held by nested handles must not be freed";
+        {
+          MutexLocker ml(Threads_lock);
+          EXPECT_TRUE(ThreadsSMRSupport::is_a_protected_JavaThread(thr))
+              << "the held ThreadsList protects the current thread";
+        }
+      } // destroy tlh2
+
+      replace_threads_list(2 * ThreadSMRFreeListBatchSize);
+      EXPECT_TRUE(ThreadsListHandleTest::is_on_to_delete_list(held))
+          << "a ThreadsList held by a hazard ptr must not be freed";
+    } // destroy tlh1
+
+    // Scan on every change so only protected ThreadsLists stay pending.
+    ThreadSMRFreeListBatchSize = 1;
+    replace_threads_list(1);
+    EXPECT_FALSE(ThreadsListHandleTest::is_on_to_delete_list(held))
+        << "an unreferenced ThreadsList must be freed by the next scan";
+    EXPECT_FALSE(ThreadsListHandleTest::is_on_to_delete_list(deferred))
+        << "a deferred ThreadsList must be freed by the next scan";
+  };
+  nomt_test_doer(doit);
+
+  ThreadSMRFreeListBatchSize = saved_batch_size;
+}
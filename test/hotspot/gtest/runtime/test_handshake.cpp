@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/os.hpp"
+#include "runtime/threadSMR.hpp"
+#include "threadHelper.inline.hpp"
+
+class HandshakeListTarget : public JavaTestThread {
+public:
+  static volatile bool _exit;
+  Semaphore* _started;
+  HandshakeListTarget(Semaphore* post, Semaphore* started)
+    : JavaTestThread(post), _started(started) {}
+  virtual ~HandshakeListTarget() {}
+  void main_run() {
+    _started->signal();
+    while (!Atomic::load_acquire(&_exit)) {
+      // Blocked, so the requester may process the handshake for us.
+      ThreadBlockInVM tbivm(this);
+      os::naked_short_sleep(1);
+    }
+  }
+};
+
+volatile bool HandshakeListTarget::_exit = false;
+
+class HandshakeListCounter : public HandshakeClosure {
+public:
+  static const int MAX_THREADS = 8;
+  Thread* _seen[MAX_THREADS];
+  volatile int _executed;
+  HandshakeListCounter() : HandshakeClosure("HandshakeListCounter"), _executed(0) {}
+  void do_thread(Thread* thread) {
+    int i = Atomic::fetch_and_add(&_executed, 1);
+    if (i < MAX_THREADS) {
+      _seen[i] = thread;
+    }
+  }
+  int count(Thread* thread) const {
+    int n = 0;
+    for (int i = 0; i < MIN2((int)_executed, MAX_THREADS); i++) {
+      if (_seen[i] == thread) {
+        n++;
+      }
+    }
+    return n;
+  }
+};
+
+class HandshakeListRequester : public JavaTestThread {
+public:
+  HandshakeListRequester(Semaphore* post) : JavaTestThread(post) {}
+  virtual ~HandshakeListRequester() {}
+  void main_run() {
+    static const int NUMBER_OF_TARGETS = 3;
+    Semaphore post;
+    Semaphore started;
+
+    HandshakeListTarget* targets[NUMBER_OF_TARGETS];
+    for (int i = 0; i < NUMBER_OF_TARGETS; i++) {
+      targets[i] = new HandshakeListTarget(&post, &started);
+      targets[i]->doit();
+    }
+    for (int i = 0; i < NUMBER_OF_TARGETS; i++) {
+      started.wait();
+    }
+
+    {
+      ThreadsListHandle tlh;
+      // The requester and a duplicated target are each handshaked once.
+      JavaThread* list[] = { targets[0], this, targets[1], targets[0], targets[2], this };
+      HandshakeListCounter cl;
+      Handshake::execute(&cl, &tlh, list, ARRAY_SIZE(list));
+      EXPECT_EQ(cl._executed, NUMBER_OF_TARGETS + 1);
+      EXPECT_EQ(cl.count(this), 1);
+      for (int i = 0; i < NUMBER_OF_TARGETS; i++) {
+        EXPECT_EQ(cl.count(targets[i]), 1);
+      }
+    }
+
+    Atomic::release_store(&HandshakeListTarget::_exit, true);
+    for (int i = 0; i < NUMBER_OF_TARGETS; i++) {
+      post.wait();
+    }
+  }
+};
+
+TEST_VM(Handshake, execute_thread_list) {
+  HandshakeListTarget::_exit = false;
+  mt_test_doer<HandshakeListRequester>();
+}
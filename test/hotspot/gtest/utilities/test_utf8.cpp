@@ -103,3 +103,42 @@ TEST_VM(utf8, jbyte_length) {
   }
 
 }
+
+TEST_VM(utf8, is_legal_utf8) {
+  unsigned char str[40];
+  const int len = (int)sizeof(str);
+
+  // All ASCII, for every length so that each possible partial word at
+  // the end is checked.
+  ::memset(str, 'A', sizeof(str));
+  for (int i = 0; i <= len; i++) {
+    EXPECT_TRUE(UTF8::is_legal_utf8(str, i, false)) << "length " << i;
+  }
+
+  // An embedded zero is illegal wherever it is.
+  for (int i = 0; i < len; i++) {
+    ::memset(str, 'A', sizeof(str));
+    str[i] = 0;
+    EXPECT_FALSE(UTF8::is_legal_utf8(str, len, false)) << "zero at " << i;
+  }
+
+  // A stray continuation byte is illegal wherever it is.
+  for (int i = 0; i < len; i++) {
+    ::memset(str, 'A', sizeof(str));
+    str[i] = 0x80;
+    EXPECT_FALSE(UTF8::is_legal_utf8(str, len, false)) << "0x80 at " << i;
+  }
+
+  // A legal two byte character is accepted wherever it is.
+  for (int i = 0; i < len - 1; i++) {
+    ::memset(str, 'A', sizeof(str));
+    str[i] = 0xC3;
+    str[i + 1] = 0xA9;
+    EXPECT_TRUE(UTF8::is_legal_utf8(str, len, false)) << "0xC3 0xA9 at " << i;
+  }
+
+  // A truncated two byte character at the end is illegal.
+  ::memset(str, 'A', sizeof(str));
+  str[len - 1] = 0xC3;
+  EXPECT_FALSE(UTF8::is_legal_utf8(str, len, false));
+}
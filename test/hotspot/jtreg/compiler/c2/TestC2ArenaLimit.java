@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary A C2 compilation whose arenas grow past C2ArenaLimit bails out
+ *          instead of installing code.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.c2.TestC2ArenaLimit
+ */
+
+package compiler.c2;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestC2ArenaLimit {
+    private static final String SKIPPED = "COMPILE SKIPPED: out of arena memory";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            run();
+            return;
+        }
+
+        // Any C2 compilation needs more than a kilobyte of arena memory.
+        OutputAnalyzer limited = compile("1024");
+        limited.shouldHaveExitValue(0);
+        limited.shouldContain(SKIPPED);
+
+        // No limit by default.
+        OutputAnalyzer unlimited = compile("0");
+        unlimited.shouldHaveExitValue(0);
+        unlimited.shouldNotContain(SKIPPED);
+    }
+
+    private static OutputAnalyzer compile(String limit) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:C2ArenaLimit=" + limit,
+            "-XX:-TieredCompilation",
+            "-Xbatch",
+            "-XX:+PrintCompilation",
+            "-XX:CompileCommand=compileonly," + TestC2ArenaLimit.class.getName() + "::work",
+            TestC2ArenaLimit.class.getName(), "run");
+        return new OutputAnalyzer(pb.start());
+    }
+
+    private static void run() {
+        int sum = 0;
+        for (int i = 0; i < 20_000; i++) {
+            sum += work(i);
+        }
+        System.out.println(sum);
+    }
+
+    private static int work(int x) {
+        int r = 0;
+        for (int i = 0; i < x % 17; i++) {
+            r += (i * x) ^ (r >>> 3);
+        }
+        return r;
+    }
+}
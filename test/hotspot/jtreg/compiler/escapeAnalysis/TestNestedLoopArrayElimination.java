@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary A small array indexed by the variables of nested short loops is
+ *          scalar replaced once all the loops are fully unrolled.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.escapeAnalysis.TestNestedLoopArrayElimination
+ */
+
+package compiler.escapeAnalysis;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+public class TestNestedLoopArrayElimination {
+    // The slow path of an array allocation that was not eliminated.
+    private static final String ALLOC_ARRAY = "(.*call,static.*wrapper for: _new_array_Java.*)";
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+DoEscapeAnalysis", "-XX:+EliminateAllocations");
+    }
+
+    // The outer loop only becomes innermost, and its index constant,
+    // after the inner loop has been fully unrolled.
+    @Test
+    @IR(failOn = ALLOC_ARRAY)
+    public static int nested(int x) {
+        int[] a = new int[4];
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                a[i] += x * j;
+            }
+        }
+        return a[0] + a[1] * 3 + a[2] * 5 + a[3] * 7;
+    }
+
+    @Run(test = "nested")
+    public static void runNested() {
+        Asserts.assertEQ(nested(1), 6 * (1 + 3 + 5 + 7));
+        Asserts.assertEQ(nested(-2), -12 * (1 + 3 + 5 + 7));
+    }
+
+    @Test
+    @IR(failOn = ALLOC_ARRAY)
+    public static int transpose(int x) {
+        int[] m = new int[4];
+        for (int i = 0; i < 2; i++) {
+            for (int j = 0; j < 2; j++) {
+                m[i * 2 + j] = x + i - j;
+            }
+        }
+        return m[1] * 100 + m[2];
+    }
+
+    @Run(test = "transpose")
+    public static void runTranspose() {
+        Asserts.assertEQ(transpose(10), 9 * 100 + 11);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Int and long add reductions in a vectorized main loop are done
+ *          with a vector accumulator and reduced once after the loop.
+ * @requires vm.compiler2.enabled
+ * @requires (os.simpleArch == "x64" & vm.cpu.features ~= ".*avx2.*") | os.arch == "aarch64"
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestUnorderedReduction
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+public class TestUnorderedReduction {
+    private static final int SIZE = 1024;
+
+    // Node names as printed by PrintIdeal.
+    private static final String ADD_VI = "(\\d+(\\s){2}(AddVI.*)+(\\s){2}===.*)";
+    private static final String ADD_VL = "(\\d+(\\s){2}(AddVL.*)+(\\s){2}===.*)";
+    private static final String ADD_REDUCTION_VI = "(\\d+(\\s){2}(AddReductionVI.*)+(\\s){2}===.*)";
+    private static final String ADD_REDUCTION_VL = "(\\d+(\\s){2}(AddReductionVL.*)+(\\s){2}===.*)";
+
+    private static int[] ia = new int[SIZE];
+    private static long[] la = new long[SIZE];
+    private static float[] fa = new float[SIZE];
+
+    public static void main(String[] args) {
+        for (int i = 0; i < SIZE; i++) {
+            ia[i] = i * 31 - 7;
+            la[i] = (long)i * 0x1_0000_0001L;
+            fa[i] = i * 0.25f;
+        }
+        TestFramework.runWithFlags("-XX:+UseSuperWord");
+    }
+
+    // One reduction after the loop, and at most one more at the end of
+    // each strip for the safepoint of a strip mined loop, rather than one
+    // per vector of the unrolled body.
+    @Test
+    @IR(counts = {ADD_VI, ">= 1", ADD_REDUCTION_VI, "<= 2"})
+    public static int sumInt(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumInt")
+    public static void runSumInt() {
+        int expected = 0;
+        for (int i = 0; i < SIZE; i++) {
+            expected += ia[i];
+        }
+        Asserts.assertEQ(sumInt(ia), expected);
+    }
+
+    @Test
+    @IR(counts = {ADD_VL, ">= 1", ADD_REDUCTION_VL, "<= 2"})
+    public static long sumLong(long[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumLong")
+    public static void runSumLong() {
+        long expected = 0;
+        for (int i = 0; i < SIZE; i++) {
+            expected += la[i];
+        }
+        Asserts.assertEQ(sumLong(la), expected);
+    }
+
+    // Float adds are not associative, so the reduction keeps its order and
+    // must give exactly the sequential result.
+    @Test
+    public static float sumFloat(float[] a) {
+        float sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumFloat")
+    public static void runSumFloat() {
+        float expected = 0;
+        for (int i = 0; i < SIZE; i++) {
+            expected += fa[i];
+        }
+        Asserts.assertEQ(sumFloat(fa), expected);
+    }
+}
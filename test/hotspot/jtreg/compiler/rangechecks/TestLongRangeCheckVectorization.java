@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Objects.checkIndex(long, long) in a long counted loop becomes an
+ *          int range check of the inner loop of the loop nest, which is
+ *          then eliminated so the inner loop vectorizes.
+ * @requires vm.compiler2.enabled
+ * @requires (os.simpleArch == "x64" & vm.cpu.features ~= ".*sse4.*") | os.arch == "aarch64"
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib /
+ * @run driver compiler.rangechecks.TestLongRangeCheckVectorization
+ */
+
+package compiler.rangechecks;
+
+import compiler.lib.ir_framework.*;
+import jdk.internal.misc.Unsafe;
+import jdk.test.lib.Asserts;
+
+import java.util.Objects;
+
+public class TestLongRangeCheckVectorization {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final long BASE = UNSAFE.arrayBaseOffset(int[].class);
+    private static final int SIZE = 10_000;
+
+    // Node names as printed by PrintIdeal.
+    private static final String CMP_UL = "(\\d+(\\s){2}(CmpUL.*)+(\\s){2}===.*)";
+    private static final String LOAD_VECTOR = "(\\d+(\\s){2}(LoadVector.*)+(\\s){2}===.*)";
+    private static final String STORE_VECTOR = "(\\d+(\\s){2}(StoreVector.*)+(\\s){2}===.*)";
+
+    private static int[] src = new int[SIZE];
+    private static int[] dst = new int[SIZE];
+
+    public static void main(String[] args) {
+        for (int i = 0; i < SIZE; i++) {
+            src[i] = i * 3;
+        }
+        TestFramework.runWithFlags("--add-exports", "java.base/jdk.internal.misc=ALL-UNNAMED",
+                                   "-XX:+UseSuperWord");
+    }
+
+    // The long check (CmpUL) is replaced by an int check on the inner
+    // loop iv, which range check elimination removes from the main loop.
+    @Test
+    @IR(failOn = CMP_UL, counts = {LOAD_VECTOR, ">= 1", STORE_VECTOR, ">= 1"})
+    public static void copyPlusOne(int[] dst, int[] src, long length) {
+        for (long i = 0; i < length; i++) {
+            long j = Objects.checkIndex(i, length);
+            int v = UNSAFE.getInt(src, BASE + j * Unsafe.ARRAY_INT_INDEX_SCALE);
+            UNSAFE.putInt(dst, BASE + j * Unsafe.ARRAY_INT_INDEX_SCALE, v + 1);
+        }
+    }
+
+    @Run(test = "copyPlusOne")
+    public static void runCopyPlusOne() {
+        copyPlusOne(dst, src, SIZE);
+        for (int i = 0; i < SIZE; i++) {
+            Asserts.assertEQ(dst[i], src[i] + 1);
+        }
+    }
+}
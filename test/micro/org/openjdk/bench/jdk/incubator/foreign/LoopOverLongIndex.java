@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.jdk.incubator.foreign;
+
+import jdk.incubator.foreign.MemoryAccess;
+import jdk.incubator.foreign.MemorySegment;
+import jdk.incubator.foreign.ResourceScope;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+import static jdk.incubator.foreign.MemoryLayouts.JAVA_INT;
+
+/**
+ * Copies with a long loop index over memory segments, which are bounds
+ * checked on longs, compared with the same copy over int[] with an int
+ * loop index.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@State(org.openjdk.jmh.annotations.Scope.Thread)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(value = 3, jvmArgsAppend = { "--add-modules=jdk.incubator.foreign" })
+public class LoopOverLongIndex {
+
+    static final int ELEM_SIZE = 1_000_000;
+    static final int CARRIER_SIZE = (int)JAVA_INT.byteSize();
+    static final int ALLOC_SIZE = ELEM_SIZE * CARRIER_SIZE;
+
+    int[] srcArray;
+    int[] dstArray;
+    MemorySegment srcSegment;
+    MemorySegment dstSegment;
+    MemorySegment srcHeapSegment;
+    MemorySegment dstHeapSegment;
+
+    @Setup
+    public void setup() {
+        srcArray = new int[ELEM_SIZE];
+        dstArray = new int[ELEM_SIZE];
+        for (int i = 0; i < ELEM_SIZE; i++) {
+            srcArray[i] = i;
+        }
+        srcSegment = MemorySegment.allocateNative(ALLOC_SIZE, ResourceScope.newConfinedScope());
+        dstSegment = MemorySegment.allocateNative(ALLOC_SIZE, ResourceScope.newConfinedScope());
+        for (int i = 0; i < ELEM_SIZE; i++) {
+            MemoryAccess.setIntAtIndex(srcSegment, i, i);
+        }
+        srcHeapSegment = MemorySegment.ofArray(srcArray);
+        dstHeapSegment = MemorySegment.ofArray(new int[ELEM_SIZE]);
+    }
+
+    @TearDown
+    public void tearDown() {
+        srcSegment.scope().close();
+        dstSegment.scope().close();
+    }
+
+    @Benchmark
+    public void array_loop() {
+        int[] src = srcArray;
+        int[] dst = dstArray;
+        for (int i = 0; i < src.length; i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    @Benchmark
+    public void segment_loop_long() {
+        MemorySegment src = srcSegment;
+        MemorySegment dst = dstSegment;
+        long count = src.byteSize() / CARRIER_SIZE;
+        for (long i = 0; i < count; i++) {
+            MemoryAccess.setIntAtIndex(dst, i, MemoryAccess.getIntAtIndex(src, i) + 1);
+        }
+    }
+
+    @Benchmark
+    public void segment_loop_int() {
+        MemorySegment src = srcSegment;
+        MemorySegment dst = dstSegment;
+        for (int i = 0; i < ELEM_SIZE; i++) {
+            MemoryAccess.setIntAtIndex(dst, i, MemoryAccess.getIntAtIndex(src, i) + 1);
+        }
+    }
+
+    @Benchmark
+    public void heap_segment_loop_long() {
+        MemorySegment src = srcHeapSegment;
+        MemorySegment dst = dstHeapSegment;
+        long count = src.byteSize() / CARRIER_SIZE;
+        for (long i = 0; i < count; i++) {
+            MemoryAccess.setIntAtIndex(dst, i, MemoryAccess.getIntAtIndex(src, i) + 1);
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Add reductions over arrays. The int and long sums are kept in a vector
+ * accumulator in the vectorized loop. The float sum keeps its order and
+ * serves as the baseline.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(value = 3)
+public class AddReduction {
+
+    @Param({"1024", "65536"})
+    public int size;
+
+    private int[] ints;
+    private long[] longs;
+    private float[] floats;
+
+    @Setup
+    public void setup() {
+        Random r = new Random(42);
+        ints = new int[size];
+        longs = new long[size];
+        floats = new float[size];
+        for (int i = 0; i < size; i++) {
+            ints[i] = r.nextInt();
+            longs[i] = r.nextLong();
+            floats[i] = r.nextFloat();
+        }
+    }
+
+    @Benchmark
+    public int sumInt() {
+        int sum = 0;
+        for (int i = 0; i < ints.length; i++) {
+            sum += ints[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public long sumLong() {
+        long sum = 0;
+        for (int i = 0; i < longs.length; i++) {
+            sum += longs[i];
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public float sumFloat() {
+        float sum = 0;
+        for (int i = 0; i < floats.length; i++) {
+            sum += floats[i];
+        }
+        return sum;
+    }
+}